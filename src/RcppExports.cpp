@@ -40,6 +40,59 @@ BEGIN_RCPP
     return rcpp_result_gen;
 END_RCPP
 }
+// auc_parallel_async
+SEXP auc_parallel_async(const arma::vec& test_prediction, const arma::vec& prediction, double threshold, double sample_percentage, int iterations, bool compute_full_auc, int n_bins, int n_threads, int batch_size);
+RcppExport SEXP _fpROC_auc_parallel_async(SEXP test_predictionSEXP, SEXP predictionSEXP, SEXP thresholdSEXP, SEXP sample_percentageSEXP, SEXP iterationsSEXP, SEXP compute_full_aucSEXP, SEXP n_binsSEXP, SEXP n_threadsSEXP, SEXP batch_sizeSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< const arma::vec& >::type test_prediction(test_predictionSEXP);
+    Rcpp::traits::input_parameter< const arma::vec& >::type prediction(predictionSEXP);
+    Rcpp::traits::input_parameter< double >::type threshold(thresholdSEXP);
+    Rcpp::traits::input_parameter< double >::type sample_percentage(sample_percentageSEXP);
+    Rcpp::traits::input_parameter< int >::type iterations(iterationsSEXP);
+    Rcpp::traits::input_parameter< bool >::type compute_full_auc(compute_full_aucSEXP);
+    Rcpp::traits::input_parameter< int >::type n_bins(n_binsSEXP);
+    Rcpp::traits::input_parameter< int >::type n_threads(n_threadsSEXP);
+    Rcpp::traits::input_parameter< int >::type batch_size(batch_sizeSEXP);
+    rcpp_result_gen = Rcpp::wrap(auc_parallel_async(test_prediction, prediction, threshold, sample_percentage, iterations, compute_full_auc, n_bins, n_threads, batch_size));
+    return rcpp_result_gen;
+END_RCPP
+}
+// auc_job_status
+Rcpp::List auc_job_status(SEXP job);
+RcppExport SEXP _fpROC_auc_job_status(SEXP jobSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< SEXP >::type job(jobSEXP);
+    rcpp_result_gen = Rcpp::wrap(auc_job_status(job));
+    return rcpp_result_gen;
+END_RCPP
+}
+// auc_job_results
+arma::mat auc_job_results(SEXP job, bool wait);
+RcppExport SEXP _fpROC_auc_job_results(SEXP jobSEXP, SEXP waitSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< SEXP >::type job(jobSEXP);
+    Rcpp::traits::input_parameter< bool >::type wait(waitSEXP);
+    rcpp_result_gen = Rcpp::wrap(auc_job_results(job, wait));
+    return rcpp_result_gen;
+END_RCPP
+}
+// auc_job_cancel
+bool auc_job_cancel(SEXP job);
+RcppExport SEXP _fpROC_auc_job_cancel(SEXP jobSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< SEXP >::type job(jobSEXP);
+    rcpp_result_gen = Rcpp::wrap(auc_job_cancel(job));
+    return rcpp_result_gen;
+END_RCPP
+}
 // summarize_auc_results
 arma::mat summarize_auc_results(const arma::mat& auc_results, bool has_complete_auc);
 RcppExport SEXP _fpROC_summarize_auc_results(SEXP auc_resultsSEXP, SEXP has_complete_aucSEXP) {
@@ -52,11 +105,47 @@ BEGIN_RCPP
     return rcpp_result_gen;
 END_RCPP
 }
+// eval_metrics_parallel
+Rcpp::List eval_metrics_parallel(const arma::vec& test_prediction, const arma::vec& prediction, const arma::vec& train_prediction, double threshold, double sample_percentage, int iterations, Rcpp::NumericVector omission_percentiles, double boyce_window, int n_bins);
+RcppExport SEXP _fpROC_eval_metrics_parallel(SEXP test_predictionSEXP, SEXP predictionSEXP, SEXP train_predictionSEXP, SEXP thresholdSEXP, SEXP sample_percentageSEXP, SEXP iterationsSEXP, SEXP omission_percentilesSEXP, SEXP boyce_windowSEXP, SEXP n_binsSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< const arma::vec& >::type test_prediction(test_predictionSEXP);
+    Rcpp::traits::input_parameter< const arma::vec& >::type prediction(predictionSEXP);
+    Rcpp::traits::input_parameter< const arma::vec& >::type train_prediction(train_predictionSEXP);
+    Rcpp::traits::input_parameter< double >::type threshold(thresholdSEXP);
+    Rcpp::traits::input_parameter< double >::type sample_percentage(sample_percentageSEXP);
+    Rcpp::traits::input_parameter< int >::type iterations(iterationsSEXP);
+    Rcpp::traits::input_parameter< Rcpp::NumericVector >::type omission_percentiles(omission_percentilesSEXP);
+    Rcpp::traits::input_parameter< double >::type boyce_window(boyce_windowSEXP);
+    Rcpp::traits::input_parameter< int >::type n_bins(n_binsSEXP);
+    rcpp_result_gen = Rcpp::wrap(eval_metrics_parallel(test_prediction, prediction, train_prediction, threshold, sample_percentage, iterations, omission_percentiles, boyce_window, n_bins));
+    return rcpp_result_gen;
+END_RCPP
+}
+// set_omp_threads
+int set_omp_threads(int n_threads);
+RcppExport SEXP _fpROC_set_omp_threads(SEXP n_threadsSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< int >::type n_threads(n_threadsSEXP);
+    rcpp_result_gen = Rcpp::wrap(set_omp_threads(n_threads));
+    return rcpp_result_gen;
+END_RCPP
+}
 
 static const R_CallMethodDef CallEntries[] = {
     {"_fpROC_trap_roc", (DL_FUNC) &_fpROC_trap_roc, 2},
     {"_fpROC_auc_parallel", (DL_FUNC) &_fpROC_auc_parallel, 7},
+    {"_fpROC_auc_parallel_async", (DL_FUNC) &_fpROC_auc_parallel_async, 9},
+    {"_fpROC_auc_job_status", (DL_FUNC) &_fpROC_auc_job_status, 1},
+    {"_fpROC_auc_job_results", (DL_FUNC) &_fpROC_auc_job_results, 2},
+    {"_fpROC_auc_job_cancel", (DL_FUNC) &_fpROC_auc_job_cancel, 1},
     {"_fpROC_summarize_auc_results", (DL_FUNC) &_fpROC_summarize_auc_results, 2},
+    {"_fpROC_eval_metrics_parallel", (DL_FUNC) &_fpROC_eval_metrics_parallel, 9},
+    {"_fpROC_set_omp_threads", (DL_FUNC) &_fpROC_set_omp_threads, 1},
     {NULL, NULL, 0}
 };
 
@@ -1,4 +1,11 @@
 #include <RcppArmadillo.h>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+#include <numeric>
+#include <random>
+#include <thread>
 #ifdef _OPENMP
 #include <omp.h>
 #endif
@@ -169,66 +176,28 @@ arma::mat bigclass_matrix(const arma::vec& test_prediction,
   return big_classpixels;
 }
 
-//' Compute AUC Metrics for single bootstrap iteration
+//' Compute AUC Metrics for a sampled set of test predictions
 //'
-//' @description Calculates partial and complete AUC metrics for a single bootstrap sample.
-//' This function is the computational core for bootstrap AUC estimation.
+//' @description Calculates partial and complete AUC metrics for an already drawn
+//' bootstrap sample (see \code{\link{calc_aucDF_arma}}, which draws it).
 //'
-//' @param big_classpixels Numeric matrix where:
-//'          - Rows represent test observations
-//'          - Columns represent bins
-//'          - Values are bin indices (n_bins, n_bins-1, ... 1)
+//' @param big_classpixels Numeric matrix of bin comparison values with one row per
+//'        sampled test observation
 //' @param fractional_area Numeric vector of cumulative fractional areas (x-axis values for ROC)
-//' @param test_prediction Numeric vector of binned test predictions (output from binning process)
-//' @param n_samp Integer specifying number of test observations to sample
+//' @param sampled_pred Numeric vector of sampled binned test predictions
 //' @param error_sens Double specifying sensitivity threshold for partial AUC (1 - error_rate)
 //' @param compute_full_auc Boolean indicating whether to compute complete AUC
 //'
-//' @return A numeric matrix with 1 row and 4 columns containing:
-//' \itemize{
-//'   \item Column 1: Complete AUC (NA if compute_full_auc = FALSE)
-//'   \item Column 2: Partial AUC for model (sensitivity > error_sens)
-//'   \item Column 3: Partial AUC for random model (reference)
-//'   \item Column 4: Ratio of model AUC to random AUC (model/reference)
-//' }
+//' @return A numeric matrix with 1 row and 4 columns (see \code{\link{calc_aucDF_arma}}).
 //'
-//' @details
-//' The function performs these steps:
-//' 1. Randomly samples test predictions (without replacement)
-//' 2. Computes omission matrix by comparing bin indices with sampled predictions
-//' 3. Calculates sensitivity as 1 - mean omission rate per bin
-//' 4. Filters bins where sensitivity exceeds threshold
-//' 5. Computes partial AUC for model and random reference
-//' 6. Optionally computes complete AUC using all bins
-//' 7. Calculates AUC ratio (model/reference)
-//'
-//' Special cases:
-//' - Returns matrix of NAs if < 2 bins meet sensitivity threshold
-//' - Returns zeros if either partial AUC is 0 (to prevent division by zero)
-//'
-//' @section Parallelization:
-//' Uses OpenMP parallelization for:
-//' - Omission matrix computation
-//'
-//' @section Algorithm Notes:
-//' - Partial AUC focuses on high-sensitivity region (error_sens to 1.0)
-//' - Random reference AUC is the theoretical AUC for uniform predictions
-//' - Binning enables efficient vectorized comparisons
-//'
-//' @seealso \code{\link{auc_parallel}} for the main bootstrap function,
-//'          \code{\link{trap_roc}} for AUC calculation method
-arma::mat calc_aucDF_arma(
+//' @seealso \code{\link{calc_aucDF_arma}}
+arma::mat calc_aucDF_sample(
      const arma::mat& big_classpixels,
      const arma::vec& fractional_area,
-     const arma::vec& test_prediction,
-     int n_samp,
+     const arma::vec& sampled_pred,
      double error_sens,
      bool compute_full_auc) {
 
-   // Random sampling without replacement
-   arma::uvec rowsID = arma::randperm(test_prediction.n_elem, n_samp);
-   const arma::vec sampled_pred = test_prediction.elem(rowsID);
-
    // Vectorized omission matrix calculation
    arma::mat omission_matrix(big_classpixels.n_rows, big_classpixels.n_cols);
 
@@ -247,12 +216,13 @@ arma::mat calc_aucDF_arma(
      return result;
    }
 
-   // Construct and sort partial AUC table
+   // Construct and sort partial AUC table. The sort must be stable: bins without
+   // background share the same x and their order along y changes the area.
    arma::mat xyTable_partial = arma::join_horiz(
      fractional_area.elem(keep_idx_partial),
      sensibility.elem(keep_idx_partial)
    );
-   xyTable_partial = xyTable_partial.rows(arma::sort_index(xyTable_partial.col(0)));
+   xyTable_partial = xyTable_partial.rows(arma::stable_sort_index(xyTable_partial.col(0)));
 
    // Compute AUCs
    const double auc_pmodel = trap_roc(xyTable_partial.col(0), xyTable_partial.col(1));
@@ -277,7 +247,7 @@ arma::mat calc_aucDF_arma(
    double auc_complete = NA_REAL;
    if (compute_full_auc) {
      arma::mat xyTable_full = arma::join_horiz(fractional_area, sensibility);
-     xyTable_full = xyTable_full.rows(arma::sort_index(xyTable_full.col(0)));
+     xyTable_full = xyTable_full.rows(arma::stable_sort_index(xyTable_full.col(0)));
      auc_complete = trap_roc(xyTable_full.col(0), xyTable_full.col(1));
    }
 
@@ -288,6 +258,112 @@ arma::mat calc_aucDF_arma(
 
    return result;
  }
+
+// Uniform integer in [0, n) by rejection sampling. Unlike
+// std::uniform_int_distribution the result is the same with every standard library.
+inline std::uint64_t draw_below(std::mt19937_64& rng, std::uint64_t n) {
+  const std::uint64_t reject_below = (std::uint64_t(0) - n) % n;  // 2^64 mod n
+  std::uint64_t r = rng();
+  while (r < reject_below) r = rng();
+  return r % n;
+}
+
+// Seed of the bootstrap generators. It is drawn on the main thread from R's RNG,
+// the only call to R's RNG of a bootstrap run, so results follow set.seed().
+struct bootstrap_seed {
+  std::uint32_t hi;
+  std::uint32_t lo;
+};
+
+bootstrap_seed draw_bootstrap_seed() {
+  bootstrap_seed seed;
+  seed.hi = static_cast<std::uint32_t>(R::runif(0.0, 4294967295.0));
+  seed.lo = static_cast<std::uint32_t>(R::runif(0.0, 4294967295.0));
+  return seed;
+}
+
+// Generator of one bootstrap iteration: the sample of an iteration does not
+// depend on the thread that computes it
+std::mt19937_64 iteration_rng(const bootstrap_seed& seed, int iteration) {
+  std::seed_seq seq{seed.hi, seed.lo, static_cast<std::uint32_t>(iteration)};
+  return std::mt19937_64(seq);
+}
+
+//' Compute AUC Metrics for single bootstrap iteration
+//'
+//' @description Calculates partial and complete AUC metrics for a single bootstrap sample.
+//' This function is the computational core for bootstrap AUC estimation.
+//'
+//' @param big_classpixels Numeric matrix where:
+//'          - Rows represent test observations
+//'          - Columns represent bins
+//'          - Values are bin indices (n_bins, n_bins-1, ... 1)
+//' @param fractional_area Numeric vector of cumulative fractional areas (x-axis values for ROC)
+//' @param test_prediction Numeric vector of binned test predictions (output from binning process)
+//' @param n_samp Integer specifying number of test observations to sample
+//' @param error_sens Double specifying sensitivity threshold for partial AUC (1 - error_rate)
+//' @param compute_full_auc Boolean indicating whether to compute complete AUC
+//' @param rng Random number generator of the iteration (\code{std::mt19937_64})
+//'
+//' @return A numeric matrix with 1 row and 4 columns containing:
+//' \itemize{
+//'   \item Column 1: Complete AUC (NA if compute_full_auc = FALSE)
+//'   \item Column 2: Partial AUC for model (sensitivity > error_sens)
+//'   \item Column 3: Partial AUC for random model (reference)
+//'   \item Column 4: Ratio of model AUC to random AUC (model/reference)
+//' }
+//'
+//' @details
+//' The function performs these steps:
+//' 1. Randomly samples test predictions without replacement (partial Fisher-Yates
+//'    shuffle driven by \code{rng}; R's RNG is not used, so it is safe in threads)
+//' 2. Computes omission matrix by comparing bin indices with sampled predictions
+//' 3. Calculates sensitivity as 1 - mean omission rate per bin
+//' 4. Filters bins where sensitivity exceeds threshold
+//' 5. Computes partial AUC for model and random reference
+//' 6. Optionally computes complete AUC using all bins
+//' 7. Calculates AUC ratio (model/reference)
+//'
+//' Special cases:
+//' - Returns matrix of NAs if < 2 bins meet sensitivity threshold
+//' - Returns zeros if either partial AUC is 0 (to prevent division by zero)
+//'
+//' @section Parallelization:
+//' Uses OpenMP parallelization for:
+//' - Omission matrix computation
+//'
+//' @section Algorithm Notes:
+//' - Partial AUC focuses on high-sensitivity region (error_sens to 1.0)
+//' - Random reference AUC is the theoretical AUC for uniform predictions
+//' - Binning enables efficient vectorized comparisons
+//'
+//' @seealso \code{\link{auc_parallel}} for the main bootstrap function,
+//'          \code{\link{trap_roc}} for AUC calculation method
+arma::mat calc_aucDF_arma(
+     const arma::mat& big_classpixels,
+     const arma::vec& fractional_area,
+     const arma::vec& test_prediction,
+     int n_samp,
+     double error_sens,
+     bool compute_full_auc,
+     std::mt19937_64& rng) {
+
+   // Random sampling without replacement (partial Fisher-Yates shuffle)
+   const int n_test = test_prediction.n_elem;
+   std::vector<int> idx(n_test);
+   std::iota(idx.begin(), idx.end(), 0);
+
+   arma::vec sampled_pred(n_samp);
+   for (int k = 0; k < n_samp; ++k) {
+     const int pick = k + static_cast<int>(draw_below(rng, n_test - k));
+     std::swap(idx[k], idx[pick]);
+     sampled_pred[k] = test_prediction[idx[k]];
+   }
+
+   return calc_aucDF_sample(big_classpixels, fractional_area, sampled_pred,
+                            error_sens, compute_full_auc);
+ }
+
 //' Execute parallel bootstrap iterations for AUC Calculation
 //'
 //' @description Coordinates the parallel execution of multiple bootstrap iterations for AUC metrics computation.
@@ -312,8 +388,10 @@ arma::mat calc_aucDF_arma(
 //' @details
 //' This function manages the bootstrap process by:
 //' 1. Creating a results matrix to store outputs from all iterations
-//' 2. Using OpenMP to parallelize iterations across available cores
-//' 3. For each iteration:
+//' 2. Drawing a seed from R's random number generator
+//' 3. Using OpenMP to parallelize iterations across available cores
+//' 4. For each iteration:
+//'    - Seeds a generator from the seed and the iteration index
 //'    - Calls \code{\link{calc_aucDF_arma}} to compute AUC metrics
 //'    - Stores results in the output matrix
 //'
@@ -322,7 +400,15 @@ arma::mat calc_aucDF_arma(
 //' - Each thread computes one bootstrap iteration independently
 //' - Thread-safe through:
 //'   * Private result storage per iteration
-//'   * Atomic writes to results matrix
+//'   * Private random number generator per iteration (R's RNG is only
+//'     called on the main thread)
+//' - Results are reproducible with \code{set.seed()} and do not depend on the
+//'   number of threads
+//'
+//' @section Interrupts:
+//' Iterations are processed in batches of 16 iterations per thread and
+//' \code{Rcpp::checkUserInterrupt()} is called between batches, so long runs
+//' can be stopped with Ctrl-C.
 //'
 //' @section Performance Notes:
 //' - Scaling is approximately linear with core count
@@ -341,17 +427,210 @@ arma::mat iterate_aucDF_arma_opt(
    // Create results matrix with 4 columns
    arma::mat results(n_iterations, 4);
 
+   // Seed drawn on the main thread from R's RNG
+   const bootstrap_seed seed = draw_bootstrap_seed();
+
+   // Iterations run in batches so user interrupts are checked between them
+   int n_threads = 1;
+#ifdef _OPENMP
+   n_threads = omp_get_max_threads();
+#endif
+   const int batch_size = 16 * n_threads;
+
+   for (int start = 0; start < n_iterations; start += batch_size) {
+     Rcpp::checkUserInterrupt();
+     const int end = std::min(n_iterations, start + batch_size);
+
 #pragma omp parallel for
-   for (int i = 0; i < n_iterations; ++i) {
-     results.row(i) = calc_aucDF_arma(
-       big_classpixels, fractional_area, test_prediction,
-       n_samp, error_sens, compute_full_auc
-     );
+     for (int i = start; i < end; ++i) {
+       std::mt19937_64 rng = iteration_rng(seed, i);
+       results.row(i) = calc_aucDF_arma(
+         big_classpixels, fractional_area, test_prediction,
+         n_samp, error_sens, compute_full_auc, rng
+       );
+     }
    }
 
    return results;
  }
 
+// Binned view of the background and test predictions shared by the evaluators
+struct binned_predictions {
+  arma::vec test_clean;   // Finite test predictions
+  arma::vec test_binned;  // Bin index (1..n_bins) of each finite test prediction
+  arma::vec bg_hist;      // Background counts per bin (ascending suitability)
+  arma::vec percent;      // Cumulative fraction of background (descending suitability)
+  double min_val;
+  double scale;
+  int n_bins;
+};
+
+//' Map a prediction value to its bin index
+//'
+//' @description Discretizes a single prediction value into the [1, n_bins] range
+//' used by \code{\link{bin_predictions}}.
+//'
+//' @param val Prediction value
+//' @param min_val Minimum of the combined background and test predictions
+//' @param scale Binning scale, (n_bins - 1) / range
+//' @param n_bins Number of bins
+//'
+//' @return The bin index as a double. Values outside the binning range are clamped
+//' to the first or last bin.
+inline double bin_value(double val, double min_val, double scale, int n_bins) {
+  val = std::floor((val - min_val) * scale);
+  val = std::max(0.0, std::min(static_cast<double>(n_bins - 1), val));
+  return val + 1.0;
+}
+
+//' Bin background and test predictions
+//'
+//' @description Cleans, combines and discretizes background and test predictions,
+//' and computes the background histogram and its cumulative distribution.
+//'
+//' @param test_prediction Numeric vector of test prediction values
+//' @param prediction Numeric vector of model predictions (background suitability data)
+//' @param n_bins Number of bins for discretization
+//'
+//' @return A \code{binned_predictions} structure with the finite and binned test predictions,
+//' the background histogram (ascending suitability), the cumulative fraction of
+//' background per bin (descending suitability, x-axis of the ROC curve) and the
+//' binning parameters.
+//'
+//' @details
+//' Non-finite values are removed from both vectors. Bins are computed on the range
+//' of the combined vectors as floor((value - min) * (n_bins-1)/range) + 1.
+//'
+//' @section Parallelization:
+//' Uses OpenMP parallelization for histogram counting.
+//'
+//' @seealso \code{\link{auc_parallel}}, \code{\link{eval_metrics_parallel}}
+binned_predictions bin_predictions(const arma::vec& test_prediction,
+                                   const arma::vec& prediction,
+                                   int n_bins) {
+  // Input validation
+  if (test_prediction.n_elem == 0 || prediction.n_elem == 0) {
+    stop("Input vectors cannot be empty");
+  }
+
+  if (n_bins <= 1) {
+    stop("Number of bins must be greater than 1");
+  }
+
+  // Process vectors
+  arma::vec test_clean = test_prediction.elem(arma::find_finite(test_prediction));
+  arma::vec pred_clean = prediction.elem(arma::find_finite(prediction));
+
+  if (pred_clean.n_elem == 0 || test_clean.n_elem == 0) {
+    stop("No finite values in prediction vectors");
+  }
+
+  // Combined vector
+  arma::vec combined = arma::join_cols(pred_clean, test_clean);
+
+  // Binning
+  const double min_val = combined.min();
+  const double max_val = combined.max();
+  const double range = max_val - min_val;
+
+  if (range <= std::numeric_limits<double>::epsilon()) {
+    stop("All prediction values are identical");
+  }
+
+  const double scale = (n_bins - 1.0) / range;
+
+  // Safe binning with clamping
+  arma::vec binned = combined;
+  binned.transform([min_val, scale, n_bins](double val) {
+    return bin_value(val, min_val, scale, n_bins);
+  });
+
+  // Split binned vectors
+  const int nprediction = pred_clean.n_elem;
+  if (nprediction >= binned.n_elem) {
+    stop("Invalid vector sizes after binning");
+  }
+
+  binned_predictions bp;
+  bp.test_clean = test_clean;
+  bp.test_binned = binned.subvec(nprediction, binned.n_elem - 1);
+  bp.min_val = min_val;
+  bp.scale = scale;
+  bp.n_bins = n_bins;
+
+  // Parallel histogram counting
+  arma::ivec counts(n_bins, arma::fill::zeros);
+  const arma::ivec bg_binned_int =
+    arma::conv_to<arma::ivec>::from(binned.subvec(0, nprediction - 1)) - 1;
+
+#pragma omp parallel for
+  for (uword i = 0; i < bg_binned_int.n_elem; ++i) {
+    int val = bg_binned_int[i];
+    if (val >= 0 && val < n_bins) {
+#pragma omp atomic
+      counts[val]++;
+    }
+  }
+  bp.bg_hist = arma::conv_to<arma::vec>::from(counts);
+
+  // Statistics - PROTECT AGAINST DIVISION BY ZERO
+  arma::vec csum = arma::cumsum(arma::flipud(bp.bg_hist));
+
+  if (csum.n_elem > 0 && csum.back() > std::numeric_limits<double>::epsilon()) {
+    bp.percent = csum / csum.back();
+  } else {
+    // Handle zero cumulative sum case
+    bp.percent = arma::vec(csum.n_elem, arma::fill::zeros);
+  }
+
+  return bp;
+}
+
+// Bootstrap sample size and bin comparison matrix shared by the bootstrap drivers
+struct bootstrap_matrix {
+  int n_samp;                  // Test predictions sampled per iteration
+  arma::mat big_classpixels;   // n_samp rows, column i filled with n_bins - i
+};
+
+//' Build the bin comparison matrix of the bootstrap
+//'
+//' @description Validates the sample percentage and builds the matrix of bin
+//' indices compared with each bootstrap sample.
+//'
+//' @param bp Binned predictions (from \code{\link{bin_predictions}})
+//' @param sample_percentage Percentage of test data to sample in each iteration, in (0, 100]
+//'
+//' @return A \code{bootstrap_matrix} structure with the number of test predictions
+//' sampled per iteration (at least 1) and a matrix with that many rows and one column
+//' per bin, column i (0-based) filled with n_bins - i.
+//'
+//' @details
+//' Samples are drawn without replacement, so the sample size must not exceed the
+//' number of finite test predictions.
+//'
+//' @seealso \code{\link{auc_parallel}}, \code{\link{auc_parallel_async}},
+//'          \code{\link{eval_metrics_parallel}}
+bootstrap_matrix make_classpixels(const binned_predictions& bp,
+                                  double sample_percentage) {
+  if (!(sample_percentage > 0 && sample_percentage <= 100)) {
+    stop("Sample percentage must be in (0, 100]");
+  }
+
+  bootstrap_matrix bm;
+
+  // Ensure at least 1 sample
+  bm.n_samp = std::max(1, static_cast<int>(
+    std::ceil((sample_percentage / 100.0) * bp.test_binned.n_elem)
+  ));
+
+  bm.big_classpixels.set_size(bm.n_samp, bp.n_bins);
+  for (int i = 0; i < bp.n_bins; ++i) {
+    bm.big_classpixels.col(i).fill(bp.n_bins - i);
+  }
+
+  return bm;
+}
+
 //' Parallel AUC and partial AUC calculation with optimized memory usage
 //'
 //' @description Computes bootstrap estimates of partial and complete AUC using parallel processing and optimized binning.
@@ -359,7 +638,8 @@ arma::mat iterate_aucDF_arma_opt(
 //' @param test_prediction Numeric vector of test prediction values
 //' @param prediction Numeric vector of model predictions (background suitability data)
 //' @param threshold Percentage threshold for partial AUC calculation (default = 5.0)
-//' @param sample_percentage Percentage of test data to sample in each iteration (default = 50.0)
+//' @param sample_percentage Percentage of test data to sample in each iteration, in (0, 100]
+//'        (default = 50.0)
 //' @param iterations Number of bootstrap iterations (default = 500)
 //' @param compute_full_auc Boolean indicating whether to compute complete AUC (default = TRUE)
 //' @param n_bins Number of bins for discretization (default = 500)
@@ -391,6 +671,12 @@ arma::mat iterate_aucDF_arma_opt(
 //' The partial AUC focuses on the high-sensitivity region defined by:
 //' Sensitivity > 1 - (threshold/100)
 //'
+//' @section Reproducibility:
+//' Each iteration draws its sample from its own Mersenne Twister generator
+//' (\code{std::mt19937_64}) seeded from R's random number generator. Results are
+//' reproducible with \code{set.seed()} and do not depend on the number of OpenMP
+//' threads (see \code{\link{set_omp_threads}}).
+//'
 //' @examples
 //' # Basic usage with random data
 //' set.seed(123)
@@ -431,94 +717,349 @@ arma::mat auc_parallel(const arma::vec& test_prediction,
                             bool compute_full_auc = true,
                             int n_bins = 500) {
 
-   // Input validation
-   if (test_prediction.n_elem == 0 || prediction.n_elem == 0) {
-     stop("Input vectors cannot be empty");
-   }
+   // Binning and background distribution
+   const binned_predictions bp = bin_predictions(test_prediction, prediction, n_bins);
 
-   if (n_bins <= 1) {
-     stop("Number of bins must be greater than 1");
-   }
+   // Parameters and matrix creation with validation
+   const double error_sens = 1.0 - (threshold / 100.0);
+   const bootstrap_matrix bm = make_classpixels(bp, sample_percentage);
 
-   // Process vectors
-   arma::vec test_clean = test_prediction.elem(arma::find_finite(test_prediction));
-   arma::vec pred_clean = prediction.elem(arma::find_finite(prediction));
+   // Parallel AUC calculation
+   return iterate_aucDF_arma_opt(bm.big_classpixels, bp.percent, bp.test_binned,
+                                 bm.n_samp, error_sens, iterations, compute_full_auc);
+ }
 
-   if (pred_clean.n_elem == 0 || test_clean.n_elem == 0) {
-     stop("No finite values in prediction vectors");
-   }
+// Asynchronous bootstrap job: iterations run on native worker threads while the
+// R session stays responsive. Workers never touch the R API; each iteration draws
+// its sample from its own generator seeded from R's RNG when the job is created.
+class auc_job {
+public:
+  auc_job(const arma::mat& big_classpixels,
+          const arma::vec& fractional_area,
+          const arma::vec& test_prediction,
+          double error_sens,
+          int n_iterations,
+          bool compute_full_auc,
+          int batch_size,
+          const bootstrap_seed& seed)
+    : big_classpixels(big_classpixels),
+      fractional_area(fractional_area),
+      test_prediction(test_prediction),
+      error_sens(error_sens),
+      n_iterations(n_iterations),
+      compute_full_auc(compute_full_auc),
+      batch_size(batch_size),
+      seed(seed),
+      results(n_iterations, 4, arma::fill::value(NA_REAL)),
+      done(n_iterations, arma::fill::zeros),
+      next_batch(0),
+      n_completed(0),
+      n_active(0),
+      stop_requested(false),
+      cancelled(false),
+      failed(false) {}
 
-   // Combined vector
-   arma::vec combined = arma::join_cols(pred_clean, test_clean);
+  ~auc_job() {
+    cancel();
+  }
 
-   // Binning
-   const double min_val = combined.min();
-   const double max_val = combined.max();
-   const double range = max_val - min_val;
+  void start(int n_threads) {
+    const int n_batches = (n_iterations + batch_size - 1) / batch_size;
+    n_threads = std::max(1, std::min(n_threads, n_batches));
+    for (int t = 0; t < n_threads; ++t) {
+      n_active++;
+      try {
+        workers.push_back(std::thread(&auc_job::run, this));
+      } catch (...) {
+        n_active--;
+        cancel();
+        throw;
+      }
+    }
+  }
 
-   if (range <= std::numeric_limits<double>::epsilon()) {
-     stop("All prediction values are identical");
-   }
+  // Request cancellation and wait for the workers to finish their current batch.
+  // A job whose iterations all completed is not reported as cancelled.
+  void cancel() {
+    if (!finished()) {
+      stop_requested = true;
+      cancelled = true;
+    }
+    join();
+    if (n_completed == n_iterations) cancelled = false;
+  }
 
-   const double scale = (n_bins - 1.0) / range;
-   arma::vec binned = (combined - min_val) * scale;
+  void join() {
+    for (size_t t = 0; t < workers.size(); ++t) {
+      if (workers[t].joinable()) workers[t].join();
+    }
+  }
 
-   // Safe binning with clamping
-   binned.transform([n_bins](double val) {
-     val = std::floor(val);
-     val = std::max(0.0, std::min(static_cast<double>(n_bins-1), val));
-     return val + 1.0;
-   });
+  int completed() const { return n_completed; }
+  int iterations() const { return n_iterations; }
+  bool finished() const { return n_active == 0; }
+  bool is_cancelled() const { return cancelled; }
+  bool has_failed() const { return failed; }
 
-   // Split binned vectors
-   const int nprediction = pred_clean.n_elem;
-   if (nprediction >= binned.n_elem) {
-     stop("Invalid vector sizes after binning");
-   }
+  // Completed rows in iteration order
+  arma::mat partial_results() {
+    std::lock_guard<std::mutex> lock(mtx);
+    return results.rows(arma::find(done));
+  }
 
-   arma::vec test_binned = binned.subvec(nprediction, binned.n_elem - 1);
-   arma::vec bg_binned = binned.subvec(0, nprediction - 1);
+private:
+  void run() {
+#ifdef _OPENMP
+    // Iterations are already spread across workers
+    omp_set_num_threads(1);
+#endif
+    try {
+      run_batches();
+    } catch (...) {
+      // Exceptions must not escape a worker thread
+      failed = true;
+      stop_requested = true;
+    }
 
-   // Parallel histogram counting
-   arma::ivec counts(n_bins, arma::fill::zeros);
-   const arma::ivec bg_binned_int = arma::conv_to<arma::ivec>::from(bg_binned) - 1;
+    n_active--;
+  }
 
-#pragma omp parallel for
-   for (uword i = 0; i < bg_binned_int.n_elem; ++i) {
-     int val = bg_binned_int[i];
-     if (val >= 0 && val < n_bins) {
-#pragma omp atomic
-       counts[n_bins - 1 - val]++;
-     }
-   }
+  void run_batches() {
+    const int n_samp = big_classpixels.n_rows;
 
-   // Statistics - PROTECT AGAINST DIVISION BY ZERO
-   arma::vec csum = arma::cumsum(arma::conv_to<arma::vec>::from(counts));
-   arma::vec percent;
+    while (!stop_requested) {
+      const int batch = next_batch++;
+      const int start = batch * batch_size;
+      if (start >= n_iterations) break;
+      const int end = std::min(n_iterations, start + batch_size);
 
-   if (csum.n_elem > 0 && csum.back() > std::numeric_limits<double>::epsilon()) {
-     percent = csum / csum.back();
-   } else {
-     // Handle zero cumulative sum case
-     percent = arma::vec(csum.n_elem, arma::fill::zeros);
-   }
+      arma::mat batch_results(end - start, 4);
+      for (int i = start; i < end; ++i) {
+        // Same generator as auc_parallel(): results do not depend on the workers
+        std::mt19937_64 rng = iteration_rng(seed, i);
+        batch_results.row(i - start) = calc_aucDF_arma(
+          big_classpixels, fractional_area, test_prediction,
+          n_samp, error_sens, compute_full_auc, rng
+        );
+      }
 
-   // Parameters - ensure at least 1 sample
-   const double error_sens = 1.0 - (threshold / 100.0);
-   const int n_samp = std::max(1, static_cast<int>(
-     std::ceil((sample_percentage / 100.0) * test_binned.n_elem)
-   ));
-
-   // Matrix creation with validation
-   arma::mat big_classpixels(n_samp, n_bins);
-   for (uword i = 0; i < n_bins; ++i) {
-     big_classpixels.col(i).fill(n_bins - i);
-   }
+      std::lock_guard<std::mutex> lock(mtx);
+      results.rows(start, end - 1) = batch_results;
+      done.subvec(start, end - 1).fill(1);
+      n_completed += end - start;
+    }
+  }
 
-   // Parallel AUC calculation
-   return iterate_aucDF_arma_opt(big_classpixels, percent, test_binned,
-                                 n_samp, error_sens, iterations, compute_full_auc);
- }
+  const arma::mat big_classpixels;
+  const arma::vec fractional_area;
+  const arma::vec test_prediction;
+  const double error_sens;
+  const int n_iterations;
+  const bool compute_full_auc;
+  const int batch_size;
+  const bootstrap_seed seed;
+
+  arma::mat results;
+  arma::uvec done;
+  std::mutex mtx;
+  std::vector<std::thread> workers;
+  std::atomic<int> next_batch;
+  std::atomic<int> n_completed;
+  std::atomic<int> n_active;
+  std::atomic<bool> stop_requested;
+  std::atomic<bool> cancelled;
+  std::atomic<bool> failed;
+};
+
+// Extract the job behind an R handle
+auc_job* get_auc_job(SEXP job) {
+  if (TYPEOF(job) != EXTPTRSXP || !Rf_inherits(job, "fpROC_auc_job")) {
+    stop("'job' must be a handle returned by auc_parallel_async()");
+  }
+  Rcpp::XPtr<auc_job> ptr(job);
+  if (ptr.get() == NULL) {
+    stop("Invalid job handle (jobs do not survive saving or restarting the session)");
+  }
+  return ptr.get();
+}
+
+//' Non-blocking AUC and partial AUC calculation
+//'
+//' @description Starts the bootstrap iterations of \code{\link{auc_parallel}} on a
+//' pool of native worker threads and returns immediately with a job handle that can
+//' be polled for progress and partial results, or cancelled.
+//'
+//' @param test_prediction Numeric vector of test prediction values
+//' @param prediction Numeric vector of model predictions (background suitability data)
+//' @param threshold Percentage threshold for partial AUC calculation (default = 5.0)
+//' @param sample_percentage Percentage of test data to sample in each iteration, in (0, 100]
+//'        (default = 50.0)
+//' @param iterations Number of bootstrap iterations (default = 500)
+//' @param compute_full_auc Boolean indicating whether to compute complete AUC (default = TRUE)
+//' @param n_bins Number of bins for discretization (default = 500)
+//' @param n_threads Number of worker threads; 0 uses all available cores (default = 0)
+//' @param batch_size Number of iterations a worker runs between cancellation checks
+//'        (default = 50)
+//'
+//' @return An external pointer of class \code{fpROC_auc_job} to be used with
+//' \code{\link{auc_job_status}}, \code{\link{auc_job_results}} and
+//' \code{\link{auc_job_cancel}}.
+//'
+//' @details
+//' Binning is done in the calling thread exactly as in \code{\link{auc_parallel}};
+//' the iterations are then split into batches that workers claim one at a time.
+//' Workers check for cancellation between batches, so a cancelled job stops after
+//' at most one batch per worker. Jobs are also cancelled when the handle is garbage
+//' collected.
+//'
+//' Bootstrap samples are drawn from per-iteration Mersenne Twister generators
+//' (\code{std::mt19937_64}) seeded from R's random number generator, with a
+//' rejection-sampling integer draw that does not depend on the C++ standard library.
+//' Results are therefore reproducible with \code{set.seed()} across platforms, do not
+//' depend on \code{n_threads} or \code{batch_size}, and match those of
+//' \code{\link{auc_parallel}} called with the same seed and arguments.
+//'
+//' @examples
+//' set.seed(123)
+//' bg_pred <- runif(1000)
+//' test_pred <- runif(500)
+//' job <- auc_parallel_async(test_pred, bg_pred, iterations = 100)
+//'
+//' # Poll progress while doing other work
+//' auc_job_status(job)
+//'
+//' # Block until done (interruptible) and collect the results
+//' results <- auc_job_results(job, wait = TRUE)
+//' summarize_auc_results(results, has_complete_auc = TRUE)
+//'
+//' @seealso \code{\link{auc_parallel}} for the blocking version
+//' @export
+// [[Rcpp::export]]
+SEXP auc_parallel_async(const arma::vec& test_prediction,
+                        const arma::vec& prediction,
+                        double threshold = 5.0,
+                        double sample_percentage = 50.0,
+                        int iterations = 500,
+                        bool compute_full_auc = true,
+                        int n_bins = 500,
+                        int n_threads = 0,
+                        int batch_size = 50) {
+
+  if (iterations < 1) {
+    stop("Number of iterations must be positive");
+  }
+
+  if (batch_size < 1) {
+    stop("Batch size must be positive");
+  }
+
+  if (n_threads <= 0) {
+    n_threads = std::max(1u, std::thread::hardware_concurrency());
+  }
+
+  // Binning and background distribution
+  const binned_predictions bp = bin_predictions(test_prediction, prediction, n_bins);
+
+  // Parameters and matrix creation with validation
+  const double error_sens = 1.0 - (threshold / 100.0);
+  const bootstrap_matrix bm = make_classpixels(bp, sample_percentage);
+
+  // Seed drawn on the main thread from R's RNG
+  const bootstrap_seed seed = draw_bootstrap_seed();
+
+  auc_job* job = new auc_job(bm.big_classpixels, bp.percent, bp.test_binned,
+                             error_sens, iterations, compute_full_auc,
+                             batch_size, seed);
+  Rcpp::XPtr<auc_job> ptr(job, true);
+  ptr.attr("class") = "fpROC_auc_job";
+  job->start(n_threads);
+
+  return ptr;
+}
+
+//' Progress of an asynchronous AUC job
+//'
+//' @param job Job handle returned by \code{\link{auc_parallel_async}}
+//'
+//' @return A list with:
+//' \itemize{
+//'   \item completed: Number of finished iterations
+//'   \item iterations: Total number of iterations
+//'   \item finished: TRUE when all workers have stopped (done or cancelled)
+//'   \item cancelled: TRUE if the job was cancelled before completing all iterations
+//'   \item failed: TRUE if a worker thread failed (partial results are kept)
+//' }
+//'
+//' @seealso \code{\link{auc_parallel_async}}
+//' @export
+// [[Rcpp::export]]
+Rcpp::List auc_job_status(SEXP job) {
+  auc_job* j = get_auc_job(job);
+
+  return Rcpp::List::create(
+    Rcpp::Named("completed") = j->completed(),
+    Rcpp::Named("iterations") = j->iterations(),
+    Rcpp::Named("finished") = j->finished(),
+    Rcpp::Named("cancelled") = j->is_cancelled(),
+    Rcpp::Named("failed") = j->has_failed()
+  );
+}
+
+//' Results of an asynchronous AUC job
+//'
+//' @param job Job handle returned by \code{\link{auc_parallel_async}}
+//' @param wait Boolean indicating whether to block until the job has finished
+//'        (default = FALSE). Waiting can be interrupted with Ctrl-C, which cancels the job.
+//'
+//' @return A numeric matrix with one row per completed iteration, in iteration order,
+//' and the 4 columns of \code{\link{auc_parallel}}. Can be summarized with
+//' \code{\link{summarize_auc_results}} while the job is still running.
+//'
+//' @seealso \code{\link{auc_parallel_async}}
+//' @export
+// [[Rcpp::export]]
+arma::mat auc_job_results(SEXP job, bool wait = false) {
+  auc_job* j = get_auc_job(job);
+
+  if (wait) {
+    while (!j->finished()) {
+      try {
+        Rcpp::checkUserInterrupt();
+      } catch (...) {
+        j->cancel();
+        throw;
+      }
+      std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    }
+  }
+
+  if (j->has_failed()) {
+    Rcpp::warning("A worker thread failed; results are incomplete");
+  }
+
+  return j->partial_results();
+}
+
+//' Cancel an asynchronous AUC job
+//'
+//' @description Asks the workers to stop after their current batch and waits for them.
+//' Iterations completed before cancellation remain available through
+//' \code{\link{auc_job_results}}.
+//'
+//' @param job Job handle returned by \code{\link{auc_parallel_async}}
+//'
+//' @return TRUE if the job was still running when cancelled, FALSE otherwise.
+//'
+//' @seealso \code{\link{auc_parallel_async}}
+//' @export
+// [[Rcpp::export]]
+bool auc_job_cancel(SEXP job) {
+  auc_job* j = get_auc_job(job);
+  const bool running = !j->finished();
+  j->cancel();
+
+  return running;
+}
 
 //' Summarize Bootstrap AUC Results
 //'
@@ -641,3 +1182,267 @@ arma::mat summarize_auc_results(const arma::mat& auc_results, bool has_complete_
 
   return summary;
 }
+
+//' Average ranks with ties
+//'
+//' @description Ranks a numeric vector assigning tied values the mean of their ranks
+//' (the \code{ties.method = "average"} of \code{\link{rank}}).
+//'
+//' @param x Numeric vector
+//'
+//' @return A numeric vector with the ranks of \code{x}.
+arma::vec average_ranks(const arma::vec& x) {
+  const uword n = x.n_elem;
+  const arma::uvec order = arma::stable_sort_index(x);
+  arma::vec ranks(n);
+
+  uword i = 0;
+  while (i < n) {
+    uword j = i;
+    while (j + 1 < n && x[order[j + 1]] == x[order[i]]) {
+      ++j;
+    }
+    const double avg_rank = (i + j) / 2.0 + 1.0;
+    for (uword k = i; k <= j; ++k) {
+      ranks[order[k]] = avg_rank;
+    }
+    i = j + 1;
+  }
+
+  return ranks;
+}
+
+//' Continuous Boyce index from binned predictions
+//'
+//' @description Computes the continuous Boyce index (Hirzel et al. 2006) using a moving
+//' window over the binned suitability range.
+//'
+//' @param test_hist Numeric vector with the number of test presences per bin (ascending suitability)
+//' @param bg_hist Numeric vector with the number of background cells per bin (ascending suitability)
+//' @param window Integer specifying the moving window width in bins
+//'
+//' @return The Spearman correlation between the predicted-to-expected ratio of each window
+//' and the window position. NA if fewer than two windows have background data or if the
+//' ratios have no variability.
+//'
+//' @details
+//' For each window the predicted-to-expected ratio is F = P/E, where P is the fraction of
+//' test presences and E the fraction of background cells falling in the window.
+//' Windows without background cells are skipped and, for consecutive repeated F values,
+//' only the last window of each run is kept, as in \code{ecospat::ecospat.boyce} with
+//' \code{rm.duplicate = TRUE}.
+//'
+//' @references Hirzel, A.H. et al. (2006) Evaluating the ability of habitat suitability
+//' models to predict species presences. Ecol. Modell., 199, 142–152.
+double boyce_index(const arma::vec& test_hist, const arma::vec& bg_hist, int window) {
+  const int n_bins = bg_hist.n_elem;
+  const double n_test = arma::accu(test_hist);
+  const double n_bg = arma::accu(bg_hist);
+
+  if (window > n_bins || n_test <= 0 || n_bg <= 0) {
+    return NA_REAL;
+  }
+
+  std::vector<double> f_ratio;
+  std::vector<double> position;
+
+  // Sliding window sums
+  double p_sum = arma::accu(test_hist.subvec(0, window - 1));
+  double e_sum = arma::accu(bg_hist.subvec(0, window - 1));
+
+  for (int s = 0; s + window <= n_bins; ++s) {
+    if (s > 0) {
+      p_sum += test_hist[s + window - 1] - test_hist[s - 1];
+      e_sum += bg_hist[s + window - 1] - bg_hist[s - 1];
+    }
+    if (e_sum <= 0) continue;
+
+    const double f = (p_sum / n_test) / (e_sum / n_bg);
+    // Keep the last window of each run of repeated values
+    if (!f_ratio.empty() && f == f_ratio.back()) {
+      position.back() = s + (window - 1) / 2.0;
+      continue;
+    }
+
+    f_ratio.push_back(f);
+    position.push_back(s + (window - 1) / 2.0);
+  }
+
+  if (f_ratio.size() < 2) {
+    return NA_REAL;
+  }
+
+  const arma::vec f_ranks = average_ranks(arma::vec(f_ratio));
+  const arma::vec pos_ranks = average_ranks(arma::vec(position));
+  const double boyce = arma::as_scalar(arma::cor(f_ranks, pos_ranks));
+
+  return std::isfinite(boyce) ? boyce : NA_REAL;
+}
+
+//' Single-pass evaluation metrics from binned predictions
+//'
+//' @description Computes the partial ROC test, the complete AUC, the continuous Boyce index
+//' and omission rates at training-presence thresholds from a single binning of the
+//' background and test predictions.
+//'
+//' @param test_prediction Numeric vector of test prediction values
+//' @param prediction Numeric vector of model predictions (background suitability data)
+//' @param train_prediction Numeric vector of model predictions at training presences
+//'        (used to define the omission thresholds)
+//' @param threshold Percentage threshold for partial AUC calculation (default = 5.0)
+//' @param sample_percentage Percentage of test data to sample in each iteration, in (0, 100]
+//'        (default = 50.0)
+//' @param iterations Number of bootstrap iterations (default = 500)
+//' @param omission_percentiles Percentiles of the training predictions used as thresholds
+//'        for omission rates (default = c(0, 10), minimum training presence and 10th percentile)
+//' @param boyce_window Width of the Boyce moving window as a percentage of the
+//'        suitability range (default = 10.0)
+//' @param n_bins Number of bins for discretization (default = 500)
+//'
+//' @return A list containing:
+//' \itemize{
+//'   \item proc_results: Matrix of bootstrap AUC results (same layout as \code{\link{auc_parallel}})
+//'   \item proc_summary: Summary of the bootstrap results (see \code{\link{summarize_auc_results}})
+//'   \item full_auc: Complete AUC computed with all test predictions
+//'   \item boyce: Continuous Boyce index
+//'   \item omission: Matrix with one row per percentile and columns percentile,
+//'         threshold (prediction value) and omission_rate (fraction of test predictions
+//'         below the threshold)
+//' }
+//'
+//' @details
+//' The background and test predictions are binned once (see \code{\link{auc_parallel}});
+//' the background histogram and the binned test vector are then shared by all metrics:
+//' 1. Partial ROC bootstrap iterations, run in parallel as in \code{\link{auc_parallel}}
+//' 2. Complete AUC from the cumulative background and test distributions
+//' 3. Continuous Boyce index from the background and test histograms
+//' 4. Omission rates comparing the finite test predictions with the training thresholds
+//'
+//' Training thresholds are taken from the sorted finite training predictions so that
+//' the given percentage of training presences falls below the threshold.
+//'
+//' @examples
+//' set.seed(123)
+//' bg_pred <- runif(1000)
+//' test_pred <- rbeta(200, 3, 1)
+//' train_pred <- rbeta(300, 3, 1)
+//' metrics <- eval_metrics_parallel(test_pred, bg_pred, train_pred,
+//'                                  iterations = 100)
+//' metrics$boyce
+//' metrics$omission
+//'
+//' @seealso \code{\link{auc_parallel}} for the partial ROC test alone,
+//'          \code{\link{evaluation_metrics}} for the R interface
+//' @export
+// [[Rcpp::export]]
+Rcpp::List eval_metrics_parallel(const arma::vec& test_prediction,
+                                 const arma::vec& prediction,
+                                 const arma::vec& train_prediction,
+                                 double threshold = 5.0,
+                                 double sample_percentage = 50.0,
+                                 int iterations = 500,
+                                 Rcpp::NumericVector omission_percentiles = Rcpp::NumericVector::create(0.0, 10.0),
+                                 double boyce_window = 10.0,
+                                 int n_bins = 500) {
+
+  // Input validation
+  arma::vec train_clean = arma::sort(train_prediction.elem(arma::find_finite(train_prediction)));
+  if (train_clean.n_elem == 0) {
+    stop("No finite values in training predictions");
+  }
+
+  if (boyce_window <= 0 || boyce_window > 100) {
+    stop("Boyce window must be in (0, 100]");
+  }
+
+  for (R_xlen_t k = 0; k < omission_percentiles.size(); ++k) {
+    if (!(omission_percentiles[k] >= 0 && omission_percentiles[k] <= 100)) {
+      stop("Omission percentiles must be in [0, 100]");
+    }
+  }
+
+  // Binning and background distribution (shared by all metrics)
+  const binned_predictions bp = bin_predictions(test_prediction, prediction, n_bins);
+  const uword n_test = bp.test_binned.n_elem;
+
+  // Partial ROC bootstrap
+  const double error_sens = 1.0 - (threshold / 100.0);
+  const bootstrap_matrix bm = make_classpixels(bp, sample_percentage);
+
+  arma::mat proc_results = iterate_aucDF_arma_opt(bm.big_classpixels, bp.percent,
+                                                  bp.test_binned, bm.n_samp, error_sens,
+                                                  iterations, true);
+
+  // Test histogram (ascending suitability)
+  arma::vec test_hist(n_bins, arma::fill::zeros);
+  for (uword i = 0; i < n_test; ++i) {
+    test_hist[static_cast<int>(bp.test_binned[i]) - 1] += 1.0;
+  }
+
+  // Complete AUC with all test predictions
+  const arma::vec sensibility = arma::cumsum(arma::flipud(test_hist)) / n_test;
+  const double full_auc = trap_roc(bp.percent, sensibility);
+
+  // Continuous Boyce index
+  const int window = std::max(1, static_cast<int>(
+    std::round((boyce_window / 100.0) * n_bins)
+  ));
+  const double boyce = boyce_index(test_hist, bp.bg_hist, window);
+
+  // Omission rates at training-presence thresholds
+  const uword n_train = train_clean.n_elem;
+  arma::mat omission(omission_percentiles.size(), 3);
+
+  for (uword k = 0; k < omission.n_rows; ++k) {
+    const double pct = omission_percentiles[k];
+    const uword idx = std::min(n_train - 1, static_cast<uword>(
+      std::floor((pct / 100.0) * n_train)
+    ));
+    const double thr = train_clean[idx];
+
+    omission(k, 0) = pct;
+    omission(k, 1) = thr;
+    omission(k, 2) = arma::accu(bp.test_clean < thr) / static_cast<double>(n_test);
+  }
+
+  return Rcpp::List::create(
+    Rcpp::Named("proc_results") = proc_results,
+    Rcpp::Named("proc_summary") = summarize_auc_results(proc_results, true),
+    Rcpp::Named("full_auc") = full_auc,
+    Rcpp::Named("boyce") = boyce,
+    Rcpp::Named("omission") = omission
+  );
+}
+
+//' Set the number of OpenMP threads
+//'
+//' @description Sets the number of threads used by the OpenMP-parallel functions
+//' (\code{\link{auc_parallel}}, \code{\link{eval_metrics_parallel}}). Mainly useful
+//' to compare results across thread counts or to limit CPU usage.
+//'
+//' @param n_threads Number of threads (must be positive)
+//'
+//' @return The previous number of threads. Always 1 when the package was built
+//' without OpenMP support.
+//'
+//' @examples
+//' old <- set_omp_threads(1)
+//' set_omp_threads(old)
+//'
+//' @seealso \code{\link{auc_parallel_async}} for the \code{n_threads} argument of
+//'          asynchronous jobs
+//' @export
+// [[Rcpp::export]]
+int set_omp_threads(int n_threads) {
+  if (n_threads < 1) {
+    stop("Number of threads must be positive");
+  }
+
+  int previous = 1;
+#ifdef _OPENMP
+  previous = omp_get_max_threads();
+  omp_set_num_threads(n_threads);
+#endif
+
+  return previous;
+}